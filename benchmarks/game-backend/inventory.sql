@@ -0,0 +1,10 @@
+-- Grant or consume an item; the wallet debit runs in the same transaction.
+\set pid random_zipfian(1, :players, :zipf)
+\set item random(1, :items)
+\set delta random(-1, 2)
+BEGIN;
+UPDATE inventory SET quantity = quantity + :delta
+    WHERE player_id = :pid AND item_id = :item;
+UPDATE wallet SET balance = balance - 10, updated_at = now()
+    WHERE player_id = :pid;
+END;
@@ -0,0 +1,6 @@
+-- Post a score to one of the leaderboards.
+\set pid random_zipfian(1, :players, :zipf)
+\set board random(1, :boards)
+\set points random(1, 50)
+UPDATE leaderboard SET score = score + :points, updated_at = now()
+    WHERE board_id = :board AND player_id = :pid;
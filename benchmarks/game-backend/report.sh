@@ -0,0 +1,47 @@
+#!/usr/bin/env bash
+#
+# Summarize a results directory written by run.sh: throughput, latency
+# percentiles from the sampled transaction logs, and size growth.
+
+set -euo pipefail
+
+OUT=${1:?usage: report.sh RESULTS_DIR}
+
+printf '%-8s %10s %9s %9s %9s %12s %12s %12s\n' \
+    am tps p50_ms p95_ms p99_ms table_growth index_growth undo_peak
+
+for dir in "$OUT"/*/; do
+    am=$(basename "$dir")
+    tps=$(awk '/^tps = / { print $3; exit }' "$dir/pgbench.out")
+
+    # Column 3 of the pgbench transaction log is the latency in microseconds.
+    # Only a sample of transactions is logged, so there is no true maximum.
+    logs=("$dir"/txn.*)
+    [ -e "${logs[0]}" ] || logs=()
+    read -r p50 p95 p99 < <(
+        awk '{ print $3 }' ${logs[@]+"${logs[@]}"} /dev/null | sort -n | awk '
+            { lat[NR] = $1 }
+            END {
+                if (NR == 0) { print "- - -"; exit }
+                printf "%.2f %.2f %.2f\n",
+                    lat[int(NR * 0.50) + 1] / 1000, lat[int(NR * 0.95) + 1] / 1000,
+                    lat[int(NR * 0.99) + 1] / 1000
+            }')
+
+    read -r tgrow igrow upeak < <(
+        awk -F, 'NR == 2 { t0 = $2; i0 = $3 }
+                 NR > 1  { t = $2; i = $3; if ($4 > u) u = $4 }
+                 END { printf "%.0f %.0f %.0f\n", t - t0, i - i0, u }' "$dir/sizes.csv")
+
+    printf '%-8s %10s %9s %9s %9s %12s %12s %12s\n' \
+        "$am" "$tps" "$p50" "$p95" "$p99" \
+        "$(numfmt --to=iec -- "$tgrow")" "$(numfmt --to=iec -- "$igrow")" \
+        "$(numfmt --to=iec -- "$upeak")"
+done
+
+for dir in "$OUT"/*/; do
+    status=$(cat "$dir/pgbench.status" 2>/dev/null || echo 0)
+    if [ "$status" -ne 0 ]; then
+        echo "$(basename "$dir"): pgbench exited with status $status, clients aborted before the end of the run"
+    fi
+done
@@ -0,0 +1,73 @@
+#!/usr/bin/env bash
+#
+# Run the game-backend benchmark against each table access method in turn.
+#
+# Connection settings come from the usual libpq environment (PGHOST,
+# PGPORT, PGDATABASE, PGUSER).  See README.md for the meaning of the knobs.
+
+set -euo pipefail
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+
+AMS=${AMS:-"heap zheap"}
+DURATION=${DURATION:-7200}
+CLIENTS=${CLIENTS:-32}
+THREADS=${THREADS:-8}
+PLAYERS=${PLAYERS:-100000}
+BOARDS=${BOARDS:-10}
+ITEMS=${ITEMS:-20}
+ZIPF=${ZIPF:-1.1}
+SAMPLE_INTERVAL=${SAMPLE_INTERVAL:-60}
+SAMPLING_RATE=${SAMPLING_RATE:-0.01}
+UNDO_DIR=${UNDO_DIR:-base/undo}
+OUT=${OUT:-results/$(date +%Y%m%d-%H%M%S)}
+
+# Never leave a day-long pgbench behind if this script dies mid-run.
+bench=
+trap 'if [ -n "$bench" ]; then kill "$bench" 2>/dev/null || true; fi' EXIT
+
+sample() {
+    psql -X -q -v undo_dir="$UNDO_DIR" -f "$HERE/sizes.sql" >> "$1/sizes.csv" ||
+        echo "== $am: size sample failed" >&2
+}
+
+for am in $AMS; do
+    dir="$OUT/$am"
+    mkdir -p "$dir"
+    echo "== $am: loading $PLAYERS players"
+
+    psql -X -q -v ON_ERROR_STOP=1 -v am="$am" -v players="$PLAYERS" \
+        -v boards="$BOARDS" -v items="$ITEMS" -f "$HERE/schema.sql"
+    psql -X -q -c CHECKPOINT
+
+    echo "epoch,table_bytes,index_bytes,undo_bytes" > "$dir/sizes.csv"
+
+    echo "== $am: running for ${DURATION}s"
+    pgbench -n -T "$DURATION" -c "$CLIENTS" -j "$THREADS" \
+        -D players="$PLAYERS" -D boards="$BOARDS" -D items="$ITEMS" \
+        -D zipf="$ZIPF" \
+        -f "$HERE/wallet.sql@40" -f "$HERE/leaderboard.sql@25" \
+        -f "$HERE/inventory.sql@15" -f "$HERE/session.sql@20" \
+        -P "$SAMPLE_INTERVAL" -l --sampling-rate="$SAMPLING_RATE" \
+        --log-prefix="$dir/txn" \
+        > "$dir/pgbench.out" 2> "$dir/progress.log" &
+    bench=$!
+
+    while kill -0 "$bench" 2>/dev/null; do
+        sample "$dir"
+        sleep "$SAMPLE_INTERVAL"
+    done
+
+    # pgbench exits with 2 when any client aborted; keep what was measured
+    # and move on to the next access method.
+    status=0
+    wait "$bench" || status=$?
+    bench=
+    echo "$status" > "$dir/pgbench.status"
+    if [ "$status" -ne 0 ]; then
+        echo "== $am: pgbench exited with status $status" >&2
+    fi
+    sample "$dir"
+done
+
+"$HERE/report.sh" "$OUT"
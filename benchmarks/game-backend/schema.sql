@@ -0,0 +1,53 @@
+-- Game-backend benchmark schema.
+--
+-- Expects the psql variables :am (table access method), :players,
+-- :boards and :items; run.sh passes them with -v.
+
+DROP TABLE IF EXISTS wallet, leaderboard, inventory, session;
+
+CREATE TABLE wallet (
+    player_id   bigint PRIMARY KEY,
+    balance     bigint NOT NULL,
+    updated_at  timestamptz NOT NULL DEFAULT now()
+) USING :am;
+
+CREATE TABLE leaderboard (
+    board_id    int NOT NULL,
+    player_id   bigint NOT NULL,
+    score       bigint NOT NULL,
+    updated_at  timestamptz NOT NULL DEFAULT now(),
+    PRIMARY KEY (board_id, player_id)
+) USING :am;
+
+CREATE TABLE inventory (
+    player_id   bigint NOT NULL,
+    item_id     int NOT NULL,
+    quantity    int NOT NULL,
+    PRIMARY KEY (player_id, item_id)
+) USING :am;
+
+CREATE TABLE session (
+    player_id   bigint PRIMARY KEY,
+    last_seen   timestamptz NOT NULL,
+    payload     text NOT NULL
+) USING :am;
+
+INSERT INTO wallet (player_id, balance)
+    SELECT p, 1000 FROM generate_series(1, :players) p;
+
+INSERT INTO leaderboard (board_id, player_id, score)
+    SELECT b, p, 0
+    FROM generate_series(1, :boards) b, generate_series(1, :players) p;
+
+INSERT INTO inventory (player_id, item_id, quantity)
+    SELECT p, i, 1
+    FROM generate_series(1, :players) p, generate_series(1, :items) i;
+
+INSERT INTO session (player_id, last_seen, payload)
+    SELECT p, now(), md5(p::text) FROM generate_series(1, :players) p;
+
+-- The secondary index makes leaderboard updates non-HOT on heap, as they
+-- are in a real ranking query workload.
+CREATE INDEX leaderboard_rank_idx ON leaderboard (board_id, score DESC);
+
+VACUUM ANALYZE wallet, leaderboard, inventory, session;
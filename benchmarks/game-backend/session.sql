@@ -0,0 +1,4 @@
+-- Session heartbeat.
+\set pid random_zipfian(1, :players, :zipf)
+UPDATE session SET last_seen = now(), payload = md5(random()::text)
+    WHERE player_id = :pid;
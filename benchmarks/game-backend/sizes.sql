@@ -0,0 +1,12 @@
+-- One CSV line of size samples: epoch, table bytes, index bytes, undo bytes.
+-- :undo_dir is relative to the data directory; reading it needs superuser.
+\pset format unaligned
+\pset tuples_only on
+\pset fieldsep ','
+SELECT extract(epoch FROM now())::bigint,
+       sum(pg_table_size(c.oid)),
+       sum(pg_indexes_size(c.oid)),
+       (SELECT coalesce(sum((pg_stat_file(:'undo_dir' || '/' || f, true)).size), 0)
+          FROM pg_ls_dir(:'undo_dir', true, false) f)
+FROM pg_class c
+WHERE c.relname IN ('wallet', 'leaderboard', 'inventory', 'session');
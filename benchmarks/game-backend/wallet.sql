@@ -0,0 +1,5 @@
+-- Credit or debit a player's wallet.
+\set pid random_zipfian(1, :players, :zipf)
+\set delta random(-100, 100)
+UPDATE wallet SET balance = balance + :delta, updated_at = now()
+    WHERE player_id = :pid;
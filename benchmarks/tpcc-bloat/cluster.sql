@@ -0,0 +1,12 @@
+-- Cluster-wide CSV sample: epoch, undo bytes, running autovacuum workers and
+-- database size.  :undo_dir is relative to the data directory; reading it
+-- needs superuser.
+\pset format unaligned
+\pset tuples_only on
+\pset fieldsep ','
+SELECT extract(epoch FROM now())::bigint,
+       (SELECT coalesce(sum((pg_stat_file(:'undo_dir' || '/' || f, true)).size), 0)
+          FROM pg_ls_dir(:'undo_dir', true, false) f),
+       (SELECT count(*) FROM pg_stat_activity
+         WHERE backend_type = 'autovacuum worker'),
+       pg_database_size(current_database());
@@ -0,0 +1,4 @@
+-- Delivery of the oldest undelivered order in each district.
+\set w_id random(1, :warehouses)
+\set carrier_id random(1, 10)
+SELECT tpcc_delivery(:w_id, :carrier_id);
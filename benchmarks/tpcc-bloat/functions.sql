@@ -0,0 +1,198 @@
+-- Server-side TPC-C-like transactions, called from the pgbench scripts.
+
+-- Non-uniform random number, clause 2.1.6 of the specification.
+CREATE OR REPLACE FUNCTION tpcc_nurand(a int, x int, y int)
+RETURNS int LANGUAGE sql VOLATILE AS $$
+    SELECT ((floor(random() * (a + 1))::int
+             | (x + floor(random() * (y - x + 1))::int))
+            + CASE a WHEN 255 THEN 157 WHEN 1023 THEN 259 ELSE 7911 END)
+           % (y - x + 1) + x;
+$$;
+
+-- Customer last name built from three syllables, clause 4.3.2.3.
+CREATE OR REPLACE FUNCTION tpcc_last_name(n int)
+RETURNS varchar LANGUAGE sql IMMUTABLE AS $$
+    SELECT s[n / 100 + 1] || s[n / 10 % 10 + 1] || s[n % 10 + 1]
+    FROM (SELECT ARRAY['BAR', 'OUGHT', 'ABLE', 'PRI', 'PRES',
+                       'ESE', 'ANTI', 'CALLY', 'ATION', 'EING'] AS s) t;
+$$;
+
+-- Customers looked up by name resolve to the middle match ordered by first
+-- name, clause 2.5.2.2.
+CREATE OR REPLACE FUNCTION tpcc_customer_by_name(p_w_id int, p_d_id int,
+                                                 p_last varchar)
+RETURNS int LANGUAGE sql STABLE AS $$
+    SELECT c_id FROM (
+        SELECT c_id, row_number() OVER (ORDER BY c_first) AS n,
+               count(*) OVER () AS total
+        FROM customer
+        WHERE c_w_id = p_w_id AND c_d_id = p_d_id AND c_last = p_last) c
+    WHERE n = (total + 1) / 2;
+$$;
+
+CREATE OR REPLACE FUNCTION tpcc_new_order(p_w_id int, p_d_id int,
+                                          p_c_id int, p_ol_cnt int)
+RETURNS void LANGUAGE plpgsql AS $$
+DECLARE
+    v_o_id      int;
+    v_items     int[];
+    v_qty       int;
+    v_price     numeric;
+    v_dist_info char(24);
+BEGIN
+    -- Stock rows are locked in item order so that concurrent orders against
+    -- the same warehouse cannot deadlock.
+    SELECT array_agg(i ORDER BY i) INTO v_items
+    FROM (SELECT tpcc_nurand(8191, 1, 100000) AS i
+          FROM generate_series(1, p_ol_cnt)) s;
+
+    UPDATE district SET d_next_o_id = d_next_o_id + 1
+    WHERE d_w_id = p_w_id AND d_id = p_d_id
+    RETURNING d_next_o_id - 1 INTO v_o_id;
+
+    PERFORM c_discount, c_last, c_credit FROM customer
+    WHERE c_w_id = p_w_id AND c_d_id = p_d_id AND c_id = p_c_id;
+
+    INSERT INTO orders (o_w_id, o_d_id, o_id, o_c_id, o_entry_d, o_ol_cnt,
+                        o_all_local)
+    VALUES (p_w_id, p_d_id, v_o_id, p_c_id, now(), p_ol_cnt, 1);
+
+    INSERT INTO new_order (no_w_id, no_d_id, no_o_id)
+    VALUES (p_w_id, p_d_id, v_o_id);
+
+    FOR n IN 1 .. p_ol_cnt LOOP
+        v_qty := 1 + floor(random() * 10)::int;
+
+        SELECT i_price INTO v_price FROM item WHERE i_id = v_items[n];
+
+        UPDATE stock
+        SET s_quantity = CASE WHEN s_quantity - v_qty >= 10
+                              THEN s_quantity - v_qty
+                              ELSE s_quantity - v_qty + 91 END,
+            s_ytd = s_ytd + v_qty,
+            s_order_cnt = s_order_cnt + 1
+        WHERE s_w_id = p_w_id AND s_i_id = v_items[n]
+        RETURNING s_dist_info INTO v_dist_info;
+
+        INSERT INTO order_line (ol_w_id, ol_d_id, ol_o_id, ol_number, ol_i_id,
+                                ol_supply_w_id, ol_quantity, ol_amount,
+                                ol_dist_info)
+        VALUES (p_w_id, p_d_id, v_o_id, n, v_items[n], p_w_id, v_qty,
+                v_qty * v_price, v_dist_info);
+    END LOOP;
+END;
+$$;
+
+CREATE OR REPLACE FUNCTION tpcc_payment(p_w_id int, p_d_id int,
+                                        p_c_w_id int, p_c_d_id int,
+                                        p_c_id int, p_c_last varchar,
+                                        p_amount numeric)
+RETURNS void LANGUAGE plpgsql AS $$
+DECLARE
+    v_c_id      int := p_c_id;
+    v_credit    char(2);
+BEGIN
+    UPDATE warehouse SET w_ytd = w_ytd + p_amount WHERE w_id = p_w_id;
+
+    UPDATE district SET d_ytd = d_ytd + p_amount
+    WHERE d_w_id = p_w_id AND d_id = p_d_id;
+
+    IF p_c_last IS NOT NULL THEN
+        v_c_id := tpcc_customer_by_name(p_c_w_id, p_c_d_id, p_c_last);
+    END IF;
+
+    UPDATE customer
+    SET c_balance = c_balance - p_amount,
+        c_ytd_payment = c_ytd_payment + p_amount,
+        c_payment_cnt = c_payment_cnt + 1
+    WHERE c_w_id = p_c_w_id AND c_d_id = p_c_d_id AND c_id = v_c_id
+    RETURNING c_credit INTO v_credit;
+
+    -- Bad-credit customers get the payment prepended to c_data, which makes
+    -- these updates grow the row.
+    IF v_credit = 'BC' THEN
+        UPDATE customer
+        SET c_data = left(format('%s %s %s %s %s %s | ', v_c_id, p_c_d_id,
+                                 p_c_w_id, p_d_id, p_w_id, p_amount)
+                          || c_data, 500)
+        WHERE c_w_id = p_c_w_id AND c_d_id = p_c_d_id AND c_id = v_c_id;
+    END IF;
+
+    INSERT INTO history (h_c_id, h_c_d_id, h_c_w_id, h_d_id, h_w_id, h_date,
+                         h_amount, h_data)
+    VALUES (v_c_id, p_c_d_id, p_c_w_id, p_d_id, p_w_id, now(), p_amount,
+            'payment');
+END;
+$$;
+
+CREATE OR REPLACE FUNCTION tpcc_order_status(p_w_id int, p_d_id int,
+                                             p_c_id int, p_c_last varchar)
+RETURNS void LANGUAGE plpgsql AS $$
+DECLARE
+    v_c_id  int := p_c_id;
+    v_o_id  int;
+BEGIN
+    IF p_c_last IS NOT NULL THEN
+        v_c_id := tpcc_customer_by_name(p_w_id, p_d_id, p_c_last);
+    END IF;
+
+    PERFORM c_balance, c_first, c_last FROM customer
+    WHERE c_w_id = p_w_id AND c_d_id = p_d_id AND c_id = v_c_id;
+
+    SELECT max(o_id) INTO v_o_id FROM orders
+    WHERE o_w_id = p_w_id AND o_d_id = p_d_id AND o_c_id = v_c_id;
+
+    PERFORM ol_i_id, ol_supply_w_id, ol_quantity, ol_amount, ol_delivery_d
+    FROM order_line
+    WHERE ol_w_id = p_w_id AND ol_d_id = p_d_id AND ol_o_id = v_o_id;
+END;
+$$;
+
+CREATE OR REPLACE FUNCTION tpcc_delivery(p_w_id int, p_carrier_id int)
+RETURNS void LANGUAGE plpgsql AS $$
+DECLARE
+    v_o_id      int;
+    v_c_id      int;
+    v_amount    numeric;
+BEGIN
+    FOR d IN 1 .. 10 LOOP
+        -- Concurrent deliveries for the same warehouse take different orders
+        -- rather than queueing behind each other.
+        SELECT no_o_id INTO v_o_id FROM new_order
+        WHERE no_w_id = p_w_id AND no_d_id = d
+        ORDER BY no_o_id LIMIT 1
+        FOR UPDATE SKIP LOCKED;
+
+        CONTINUE WHEN v_o_id IS NULL;
+
+        DELETE FROM new_order
+        WHERE no_w_id = p_w_id AND no_d_id = d AND no_o_id = v_o_id;
+
+        UPDATE orders SET o_carrier_id = p_carrier_id
+        WHERE o_w_id = p_w_id AND o_d_id = d AND o_id = v_o_id
+        RETURNING o_c_id INTO v_c_id;
+
+        WITH delivered AS (
+            UPDATE order_line SET ol_delivery_d = now()
+            WHERE ol_w_id = p_w_id AND ol_d_id = d AND ol_o_id = v_o_id
+            RETURNING ol_amount)
+        SELECT sum(ol_amount) INTO v_amount FROM delivered;
+
+        UPDATE customer
+        SET c_balance = c_balance + v_amount,
+            c_delivery_cnt = c_delivery_cnt + 1
+        WHERE c_w_id = p_w_id AND c_d_id = d AND c_id = v_c_id;
+    END LOOP;
+END;
+$$;
+
+CREATE OR REPLACE FUNCTION tpcc_stock_level(p_w_id int, p_d_id int,
+                                            p_threshold int)
+RETURNS bigint LANGUAGE sql STABLE AS $$
+    SELECT count(DISTINCT s_i_id)
+    FROM district
+    JOIN order_line ON ol_w_id = d_w_id AND ol_d_id = d_id
+                   AND ol_o_id >= d_next_o_id - 20 AND ol_o_id < d_next_o_id
+    JOIN stock ON s_w_id = ol_w_id AND s_i_id = ol_i_id
+    WHERE d_w_id = p_w_id AND d_id = p_d_id AND s_quantity < p_threshold;
+$$;
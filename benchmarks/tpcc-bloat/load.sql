@@ -0,0 +1,68 @@
+-- Initial population, following clause 4.3.3 of the specification where it
+-- matters for update behaviour.  Expects the psql variable :warehouses.
+
+INSERT INTO item (i_id, i_im_id, i_name, i_price, i_data)
+    SELECT i, 1 + floor(random() * 10000)::int, left(md5(i::text), 24),
+           1 + floor(random() * 9900)::int / 100.0,
+           left(md5(random()::text) || md5(random()::text), 26 + i % 25)
+    FROM generate_series(1, 100000) i;
+
+INSERT INTO warehouse (w_id, w_name, w_address, w_tax, w_ytd)
+    SELECT w, 'W' || w, md5(w::text), floor(random() * 2000) / 10000.0,
+           300000
+    FROM generate_series(1, :warehouses) w;
+
+INSERT INTO district (d_w_id, d_id, d_name, d_address, d_tax, d_ytd,
+                      d_next_o_id)
+    SELECT w, d, 'D' || d, md5((w * 10 + d)::text),
+           floor(random() * 2000) / 10000.0, 30000, 3001
+    FROM generate_series(1, :warehouses) w, generate_series(1, 10) d;
+
+INSERT INTO customer
+    SELECT w, d, c,
+           left(md5(random()::text), 8 + c % 9),
+           tpcc_last_name(CASE WHEN c <= 1000 THEN c - 1
+                               ELSE tpcc_nurand(255, 0, 999) END),
+           md5(random()::text), lpad(c::text, 16, '0'), now(),
+           CASE WHEN random() < 0.1 THEN 'BC' ELSE 'GC' END,
+           50000, floor(random() * 5000) / 10000.0, -10, 10, 1, 0,
+           left(repeat(md5(random()::text), 16), 300 + c % 201)
+    FROM generate_series(1, :warehouses) w, generate_series(1, 10) d,
+         generate_series(1, 3000) c;
+
+INSERT INTO history
+    SELECT c, d, w, d, w, now(), 10, left(md5(random()::text), 24)
+    FROM generate_series(1, :warehouses) w, generate_series(1, 10) d,
+         generate_series(1, 3000) c;
+
+-- o_c_id walks a permutation of the customers (7919 is coprime to 3000);
+-- the line count is derived from the key so order_line can match it.
+INSERT INTO orders
+    SELECT w, d, o, o * 7919 % 3000 + 1, now(),
+           CASE WHEN o <= 2100 THEN 1 + o % 10 END,
+           5 + (o * 31 + d * 17 + w) % 11, 1
+    FROM generate_series(1, :warehouses) w, generate_series(1, 10) d,
+         generate_series(1, 3000) o;
+
+INSERT INTO order_line
+    SELECT o_w_id, o_d_id, o_id, n, 1 + floor(random() * 100000)::int, o_w_id,
+           CASE WHEN o_id <= 2100 THEN o_entry_d END, 5,
+           CASE WHEN o_id <= 2100 THEN 0
+                ELSE floor(random() * 999999) / 100.0 END,
+           left(md5(random()::text), 24)
+    FROM orders, generate_series(1, o_ol_cnt) n;
+
+INSERT INTO new_order
+    SELECT w, d, o
+    FROM generate_series(1, :warehouses) w, generate_series(1, 10) d,
+         generate_series(2101, 3000) o;
+
+INSERT INTO stock
+    SELECT w, i, 10 + floor(random() * 91)::int, left(md5(random()::text), 24),
+           0, 0, 0, left(md5(random()::text) || md5(random()::text), 26 + i % 25)
+    FROM generate_series(1, :warehouses) w, generate_series(1, 100000) i;
+
+CREATE INDEX customer_name_idx ON customer (c_w_id, c_d_id, c_last, c_first);
+CREATE INDEX orders_customer_idx ON orders (o_w_id, o_d_id, o_c_id, o_id);
+
+VACUUM ANALYZE;
@@ -0,0 +1,13 @@
+-- New-order; one in a hundred is rolled back by the client.
+\set w_id random(1, :warehouses)
+\set d_id random(1, 10)
+\set c_id ((random(0, 1023) | random(1, 3000)) + 259) % 3000 + 1
+\set ol_cnt random(5, 15)
+\set rollback random(1, 100) = 1
+BEGIN;
+SELECT tpcc_new_order(:w_id, :d_id, :c_id, :ol_cnt);
+\if :rollback
+ROLLBACK;
+\else
+END;
+\endif
@@ -0,0 +1,8 @@
+-- Order-status; 60% look the customer up by last name.
+\set w_id random(1, :warehouses)
+\set d_id random(1, 10)
+\set c_id ((random(0, 1023) | random(1, 3000)) + 259) % 3000 + 1
+\set by_name random(1, 100) <= 60
+\set c_last ((random(0, 255) | random(0, 999)) + 157) % 1000
+SELECT tpcc_order_status(:w_id, :d_id, :c_id,
+    CASE WHEN :by_name THEN tpcc_last_name(:c_last) END);
@@ -0,0 +1,12 @@
+-- Payment; 15% pay through a remote warehouse, 60% look the customer up
+-- by last name.
+\set w_id random(1, :warehouses)
+\set d_id random(1, 10)
+\set c_w_id CASE WHEN random(1, 100) <= 15 THEN random(1, :warehouses) ELSE :w_id END
+\set c_d_id CASE WHEN :c_w_id <> :w_id THEN random(1, 10) ELSE :d_id END
+\set c_id ((random(0, 1023) | random(1, 3000)) + 259) % 3000 + 1
+\set by_name random(1, 100) <= 60
+\set c_last ((random(0, 255) | random(0, 999)) + 157) % 1000
+\set amount random(100, 500000)
+SELECT tpcc_payment(:w_id, :d_id, :c_w_id, :c_d_id, :c_id,
+    CASE WHEN :by_name THEN tpcc_last_name(:c_last) END, :amount / 100.0);
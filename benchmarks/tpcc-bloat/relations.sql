@@ -0,0 +1,12 @@
+-- Per-relation CSV samples: epoch, relation, table bytes, index bytes, live
+-- and dead tuples, and the number of autovacuum and autoanalyze runs so far.
+\pset format unaligned
+\pset tuples_only on
+\pset fieldsep ','
+SELECT extract(epoch FROM now())::bigint, relname,
+       pg_table_size(relid), pg_indexes_size(relid),
+       n_live_tup, n_dead_tup, autovacuum_count, autoanalyze_count
+FROM pg_stat_user_tables
+WHERE relname IN ('warehouse', 'district', 'customer', 'history', 'new_order',
+                  'orders', 'order_line', 'item', 'stock')
+ORDER BY relname;
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+#
+# Summarize a results directory written by run.sh: throughput decay between
+# the first and last hour, and per-relation size growth and autovacuum runs.
+
+set -euo pipefail
+
+OUT=${1:?usage: report.sh RESULTS_DIR}
+
+for dir in "$OUT"/*/; do
+    am=$(basename "$dir")
+    echo "== $am"
+
+    status=$(cat "$dir/pgbench.status" 2>/dev/null || echo 0)
+    if [ "$status" -ne 0 ]; then
+        echo "pgbench exited with status $status, clients aborted before the end of the run"
+    fi
+
+    # Progress lines look like "progress: 60.0 s, 1234.5 tps, lat 25.9 ms ...".
+    awk '/^progress: / { sub(/,/, "", $2); print $2, $4 }' "$dir/progress.log" \
+        > "$dir/throughput.txt"
+    awk '{ t[NR] = $1; tps[NR] = $2 }
+         END {
+            if (NR == 0) { print "no progress reports"; exit }
+            for (i = 1; i <= NR; i++) {
+                if (t[i] <= 3600) { first += tps[i]; nf++ }
+                if (t[i] > t[NR] - 3600) { last += tps[i]; nl++ }
+            }
+            # Intervals longer than an hour leave the first hour empty, and a
+            # run whose clients all aborted can report zero tps.
+            f = l = change = "n/a"
+            if (nf) f = sprintf("%.1f", first / nf)
+            if (nl) l = sprintf("%.1f", last / nl)
+            if (nf && nl && first > 0)
+                change = sprintf("%+.1f%%", (last / nl - first / nf) / (first / nf) * 100)
+            printf "tps first hour %s, last hour %s, change %s\n", f, l, change
+         }' "$dir/throughput.txt"
+
+    awk -F, 'NR > 1 { if ($2 > u) u = $2; if ($3 > a) a = $3
+                      if (d0 == "") d0 = $4; d = $4 }
+             END { printf "database %.0f -> %.0f bytes, undo peak %.0f bytes, max autovacuum workers %d\n",
+                       d0, d, u, a }' "$dir/cluster.csv"
+
+    printf '%-12s %14s %14s %14s %14s %8s %10s\n' \
+        relation table_start table_end index_start index_end avruns bytes/live
+    awk -F, 'NR > 1 {
+                if (!($2 in t0)) { t0[$2] = $3; i0[$2] = $4; a0[$2] = $7 }
+                t[$2] = $3; i[$2] = $4; live[$2] = $5; a[$2] = $7
+             }
+             END {
+                for (r in t)
+                    printf "%-12s %14.0f %14.0f %14.0f %14.0f %8d %10.1f\n", r,
+                        t0[r], t[r], i0[r], i[r], a[r] - a0[r],
+                        (live[r] > 0 ? t[r] / live[r] : 0)
+             }' "$dir/relations.csv" | sort
+done
@@ -0,0 +1,74 @@
+#!/usr/bin/env bash
+#
+# Run the TPC-C-like bloat benchmark against each table access method in
+# turn, sampling sizes and autovacuum activity while it runs.
+#
+# Connection settings come from the usual libpq environment (PGHOST,
+# PGPORT, PGDATABASE, PGUSER).  See README.md for the meaning of the knobs.
+
+set -euo pipefail
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+
+AMS=${AMS:-"heap zheap"}
+DURATION=${DURATION:-86400}
+CLIENTS=${CLIENTS:-32}
+THREADS=${THREADS:-8}
+WAREHOUSES=${WAREHOUSES:-10}
+SAMPLE_INTERVAL=${SAMPLE_INTERVAL:-60}
+UNDO_DIR=${UNDO_DIR:-base/undo}
+OUT=${OUT:-results/$(date +%Y%m%d-%H%M%S)}
+
+# Never leave a day-long pgbench behind if this script dies mid-run.
+bench=
+trap 'if [ -n "$bench" ]; then kill "$bench" 2>/dev/null || true; fi' EXIT
+
+sample() {
+    psql -X -q -f "$HERE/relations.sql" >> "$1/relations.csv" ||
+        echo "== $am: relation sample failed" >&2
+    psql -X -q -v undo_dir="$UNDO_DIR" -f "$HERE/cluster.sql" >> "$1/cluster.csv" ||
+        echo "== $am: cluster sample failed" >&2
+}
+
+for am in $AMS; do
+    dir="$OUT/$am"
+    mkdir -p "$dir"
+    echo "== $am: loading $WAREHOUSES warehouses"
+
+    psql -X -q -v ON_ERROR_STOP=1 -v am="$am" -f "$HERE/schema.sql"
+    psql -X -q -v ON_ERROR_STOP=1 -f "$HERE/functions.sql"
+    psql -X -q -v ON_ERROR_STOP=1 -v warehouses="$WAREHOUSES" -f "$HERE/load.sql"
+    psql -X -q -c CHECKPOINT
+
+    echo "epoch,relname,table_bytes,index_bytes,n_live_tup,n_dead_tup,autovacuum_count,autoanalyze_count" \
+        > "$dir/relations.csv"
+    echo "epoch,undo_bytes,autovacuum_workers,database_bytes" > "$dir/cluster.csv"
+
+    echo "== $am: running for ${DURATION}s"
+    pgbench -n -T "$DURATION" -c "$CLIENTS" -j "$THREADS" \
+        -D warehouses="$WAREHOUSES" \
+        -f "$HERE/new_order.sql@45" -f "$HERE/payment.sql@43" \
+        -f "$HERE/order_status.sql@4" -f "$HERE/delivery.sql@4" \
+        -f "$HERE/stock_level.sql@4" \
+        -P "$SAMPLE_INTERVAL" \
+        > "$dir/pgbench.out" 2> "$dir/progress.log" &
+    bench=$!
+
+    while kill -0 "$bench" 2>/dev/null; do
+        sample "$dir"
+        sleep "$SAMPLE_INTERVAL"
+    done
+
+    # pgbench exits with 2 when any client aborted; keep what was measured
+    # and move on to the next access method.
+    status=0
+    wait "$bench" || status=$?
+    bench=
+    echo "$status" > "$dir/pgbench.status"
+    if [ "$status" -ne 0 ]; then
+        echo "== $am: pgbench exited with status $status" >&2
+    fi
+    sample "$dir"
+done
+
+"$HERE/report.sh" "$OUT"
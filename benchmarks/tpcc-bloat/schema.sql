@@ -0,0 +1,113 @@
+-- TPC-C-like schema.
+--
+-- Expects the psql variable :am (table access method).  Column sets are
+-- trimmed to what the transactions in functions.sql touch; the row widths
+-- stay close to the specification.  Year-to-date and balance columns are
+-- unbounded numeric: without think times a day-long run pushes them past
+-- the specified precision.
+
+DROP TABLE IF EXISTS warehouse, district, customer, history, new_order,
+    orders, order_line, item, stock;
+
+CREATE TABLE warehouse (
+    w_id        int PRIMARY KEY,
+    w_name      varchar(10) NOT NULL,
+    w_address   varchar(80) NOT NULL,
+    w_tax       numeric(4,4) NOT NULL,
+    w_ytd       numeric NOT NULL
+) USING :am;
+
+CREATE TABLE district (
+    d_w_id      int NOT NULL,
+    d_id        int NOT NULL,
+    d_name      varchar(10) NOT NULL,
+    d_address   varchar(80) NOT NULL,
+    d_tax       numeric(4,4) NOT NULL,
+    d_ytd       numeric NOT NULL,
+    d_next_o_id int NOT NULL,
+    PRIMARY KEY (d_w_id, d_id)
+) USING :am;
+
+CREATE TABLE customer (
+    c_w_id          int NOT NULL,
+    c_d_id          int NOT NULL,
+    c_id            int NOT NULL,
+    c_first         varchar(16) NOT NULL,
+    c_last          varchar(16) NOT NULL,
+    c_address       varchar(80) NOT NULL,
+    c_phone         char(16) NOT NULL,
+    c_since         timestamp NOT NULL,
+    c_credit        char(2) NOT NULL,
+    c_credit_lim    numeric(12,2) NOT NULL,
+    c_discount      numeric(4,4) NOT NULL,
+    c_balance       numeric NOT NULL,
+    c_ytd_payment   numeric NOT NULL,
+    c_payment_cnt   int NOT NULL,
+    c_delivery_cnt  int NOT NULL,
+    c_data          varchar(500) NOT NULL,
+    PRIMARY KEY (c_w_id, c_d_id, c_id)
+) USING :am;
+
+CREATE TABLE history (
+    h_c_id      int NOT NULL,
+    h_c_d_id    int NOT NULL,
+    h_c_w_id    int NOT NULL,
+    h_d_id      int NOT NULL,
+    h_w_id      int NOT NULL,
+    h_date      timestamp NOT NULL,
+    h_amount    numeric(6,2) NOT NULL,
+    h_data      varchar(24) NOT NULL
+) USING :am;
+
+CREATE TABLE new_order (
+    no_w_id     int NOT NULL,
+    no_d_id     int NOT NULL,
+    no_o_id     int NOT NULL,
+    PRIMARY KEY (no_w_id, no_d_id, no_o_id)
+) USING :am;
+
+CREATE TABLE orders (
+    o_w_id          int NOT NULL,
+    o_d_id          int NOT NULL,
+    o_id            int NOT NULL,
+    o_c_id          int NOT NULL,
+    o_entry_d       timestamp NOT NULL,
+    o_carrier_id    int,
+    o_ol_cnt        int NOT NULL,
+    o_all_local     int NOT NULL,
+    PRIMARY KEY (o_w_id, o_d_id, o_id)
+) USING :am;
+
+CREATE TABLE order_line (
+    ol_w_id         int NOT NULL,
+    ol_d_id         int NOT NULL,
+    ol_o_id         int NOT NULL,
+    ol_number       int NOT NULL,
+    ol_i_id         int NOT NULL,
+    ol_supply_w_id  int NOT NULL,
+    ol_delivery_d   timestamp,
+    ol_quantity     int NOT NULL,
+    ol_amount       numeric(6,2) NOT NULL,
+    ol_dist_info    char(24) NOT NULL,
+    PRIMARY KEY (ol_w_id, ol_d_id, ol_o_id, ol_number)
+) USING :am;
+
+CREATE TABLE item (
+    i_id        int PRIMARY KEY,
+    i_im_id     int NOT NULL,
+    i_name      varchar(24) NOT NULL,
+    i_price     numeric(5,2) NOT NULL,
+    i_data      varchar(50) NOT NULL
+) USING :am;
+
+CREATE TABLE stock (
+    s_w_id          int NOT NULL,
+    s_i_id          int NOT NULL,
+    s_quantity      int NOT NULL,
+    s_dist_info     char(24) NOT NULL,
+    s_ytd           int NOT NULL,
+    s_order_cnt     int NOT NULL,
+    s_remote_cnt    int NOT NULL,
+    s_data          varchar(50) NOT NULL,
+    PRIMARY KEY (s_w_id, s_i_id)
+) USING :am;